@@ -7,7 +7,17 @@ const std::vector<std::vector<float>> SHARPENING_MATRIX = {{0, -1, 0}, {-1, 5, -
 
 const std::vector<std::vector<float>> EDGE_MATRIX = {{0, -1, 0}, {-1, 4, -1}, {0, -1, 0}};
 
-enum FilterName { CROP, GREYSCALE, NEGATIVE, SHARPENING, EDGEDETECTION, GAUSSIANBLUR, DROP_EFFECT, UNKNOWN_FILTER };
+enum FilterName {
+    CROP,
+    GREYSCALE,
+    NEGATIVE,
+    SHARPENING,
+    EDGEDETECTION,
+    GAUSSIANBLUR,
+    BOX_BLUR,
+    DROP_EFFECT,
+    UNKNOWN_FILTER
+};
 using Matrix = std::vector<std::vector<Pixel>>;
 
 class Filter {
@@ -52,13 +62,16 @@ private:
 
 class EdgeDetectionFilter : public Filter {
 public:
-    explicit EdgeDetectionFilter(float threshold) : kernel_(EDGE_MATRIX), threshold_(threshold) {
+    // With a positive radius the threshold is taken relative to the mean response in the surrounding window.
+    explicit EdgeDetectionFilter(float threshold, int32_t radius = 0)
+        : kernel_(EDGE_MATRIX), threshold_(threshold), radius_(radius) {
     }
     Matrix Apply(const Matrix &input) const override;
 
 private:
     std::vector<std::vector<float>> kernel_;
     float threshold_;
+    int32_t radius_;
 };
 
 class GaussianBlurFilter : public Filter {
@@ -71,6 +84,16 @@ private:
     float sigma_;
 };
 
+class BoxBlurFilter : public Filter {
+public:
+    explicit BoxBlurFilter(int32_t radius) : radius_(radius) {
+    }
+    Matrix Apply(const Matrix &input) const override;
+
+private:
+    int32_t radius_;
+};
+
 class DropEffectFilter : public Filter {
 public:
     explicit DropEffectFilter(float strength, float center_x = -1.0f, float center_y = -1.0f)
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include "filters.h"
+
+struct ChannelSums {
+    uint64_t red = 0;
+    uint64_t green = 0;
+    uint64_t blue = 0;
+};
+
+struct ChannelStats {
+    float red = 0;
+    float green = 0;
+    float blue = 0;
+};
+
+// Summed-area tables of pixel values and, on request, of their squares. Any window sum is
+// four lookups, so box statistics cost the same for every radius.
+class IntegralImage {
+public:
+    explicit IntegralImage(const Matrix &input, bool with_squares = false);
+    // Window bounds are inclusive and clipped to the image.
+    ChannelSums Sum(int32_t top, int32_t left, int32_t bottom, int32_t right) const;
+    ChannelSums SquaredSum(int32_t top, int32_t left, int32_t bottom, int32_t right) const;
+    int64_t Area(int32_t top, int32_t left, int32_t bottom, int32_t right) const;
+    ChannelStats Mean(int32_t y, int32_t x, int32_t radius) const;
+    ChannelStats Variance(int32_t y, int32_t x, int32_t radius) const;
+
+private:
+    int32_t width_;
+    int32_t height_;
+    std::vector<ChannelSums> sums_;
+    std::vector<ChannelSums> squared_sums_;
+    size_t Index(int32_t y, int32_t x) const;
+    int32_t ClampRadius(int32_t radius) const;
+    ChannelSums Lookup(const std::vector<ChannelSums> &table, int32_t top, int32_t left, int32_t bottom,
+                       int32_t right) const;
+};
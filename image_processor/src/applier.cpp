@@ -17,6 +17,8 @@ FilterName Applier::GetFilterType(const std::string& filter_name) {
         return EDGEDETECTION;
     } else if (filter_name == "-blur") {
         return GAUSSIANBLUR;
+    } else if (filter_name == "-box") {
+        return BOX_BLUR;
     } else if (filter_name == "-drop") {
         return DROP_EFFECT;
     } else {
@@ -66,7 +68,14 @@ void Applier::ApplyFilters() {
                     throw std::runtime_error("Edge detection filter requires a threshold parameter.");
                 }
                 float threshold = std::stof(parameters[0]);
-                EdgeDetectionFilter edge(threshold);
+                int32_t radius = 0;
+                if (parameters.size() >= 2) {
+                    radius = std::stoi(parameters[1]);
+                    if (radius < 0) {
+                        throw std::runtime_error("Edge detection radius must be non-negative.");
+                    }
+                }
+                EdgeDetectionFilter edge(threshold, radius);
                 current_matrix = edge.Apply(current_matrix);
                 break;
             }
@@ -79,6 +88,14 @@ void Applier::ApplyFilters() {
                 current_matrix = blur.Apply(current_matrix);
                 break;
             }
+            case BOX_BLUR: {
+                if (parameters.empty() || std::stoi(parameters[0]) < 0) {
+                    throw std::runtime_error("Box blur filter requires a non-negative radius parameter.");
+                }
+                BoxBlurFilter box(std::stoi(parameters[0]));
+                current_matrix = box.Apply(current_matrix);
+                break;
+            }
             case DROP_EFFECT: {
                 if (parameters.empty() || std::stof(parameters[0]) < DropRestriction) {
                     throw std::runtime_error("Drop effect filter requires a strength parameter not less than 2.");
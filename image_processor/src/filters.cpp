@@ -1,4 +1,5 @@
 #include "../include/filters.h"
+#include "../include/integral.h"
 #include <cmath>
 #include <algorithm>
 
@@ -101,6 +102,18 @@ Matrix EdgeDetectionFilter::Apply(const Matrix &input) const {
     Matrix grey_scale = gs.Apply(input);
     Matrix convolution = ApplyConvolution(grey_scale, kernel_);
     Matrix output = convolution;
+    if (radius_ > 0) {
+        IntegralImage integral(convolution);
+        for (int32_t y = 0; y < height; y++) {
+            for (int32_t x = 0; x < width; x++) {
+                float value = static_cast<float>(convolution[y][x].red) / static_cast<float>(MaxPixelValue);
+                float local_mean = integral.Mean(y, x, radius_).red / static_cast<float>(MaxPixelValue);
+                uint8_t color = (value > local_mean + threshold_) ? MaxPixelValue : 0;
+                output[y][x].red = output[y][x].green = output[y][x].blue = color;
+            }
+        }
+        return output;
+    }
     for (int32_t y = 0; y < height; y++) {
         for (int32_t x = 0; x < width; x++) {
             float value = static_cast<float>(convolution[y][x].red) / static_cast<float>(MaxPixelValue);
@@ -137,6 +150,22 @@ Matrix GaussianBlurFilter::Apply(const Matrix &input) const {
     return output;
 }
 
+Matrix BoxBlurFilter::Apply(const Matrix &input) const {
+    int32_t height = static_cast<int32_t>(input.size());
+    int32_t width = (height > 0) ? static_cast<int32_t>(input[0].size()) : 0;
+    IntegralImage integral(input);
+    Matrix output = input;
+    for (int32_t y = 0; y < height; y++) {
+        for (int32_t x = 0; x < width; x++) {
+            ChannelStats mean = integral.Mean(y, x, radius_);
+            output[y][x].red = static_cast<uint8_t>(std::round(mean.red));
+            output[y][x].green = static_cast<uint8_t>(std::round(mean.green));
+            output[y][x].blue = static_cast<uint8_t>(std::round(mean.blue));
+        }
+    }
+    return output;
+}
+
 Matrix DropEffectFilter::Apply(const Matrix &input) const {
     int32_t height = static_cast<int32_t>(input.size());
     if (height == 0) {
@@ -0,0 +1,134 @@
+#include "../include/integral.h"
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+
+// Splits [0, count) into contiguous chunks and runs the job on each chunk in its own thread.
+static void RunParallel(int32_t count, const std::function<void(int32_t, int32_t)> &job) {
+    int32_t threads_count = std::max(1, static_cast<int32_t>(std::thread::hardware_concurrency()));
+    threads_count = std::min(threads_count, count);
+    if (threads_count <= 1) {
+        job(0, count);
+        return;
+    }
+    int32_t chunk = (count + threads_count - 1) / threads_count;
+    std::vector<std::thread> threads;
+    for (int32_t begin = 0; begin < count; begin += chunk) {
+        threads.emplace_back(job, begin, std::min(begin + chunk, count));
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+}
+
+static ChannelSums operator+(const ChannelSums &first, const ChannelSums &second) {
+    return {first.red + second.red, first.green + second.green, first.blue + second.blue};
+}
+
+IntegralImage::IntegralImage(const Matrix &input, bool with_squares)
+    : width_(input.empty() ? 0 : static_cast<int32_t>(input[0].size())),
+      height_(static_cast<int32_t>(input.size())),
+      sums_(static_cast<size_t>(width_ + 1) * (height_ + 1)) {
+    if (with_squares) {
+        squared_sums_.resize(sums_.size());
+    }
+    // Rows are independent in the first pass and columns are independent in the second,
+    // so each pass is split between threads.
+    RunParallel(height_, [&](int32_t begin, int32_t end) {
+        for (int32_t y = begin; y < end; y++) {
+            for (int32_t x = 0; x < width_; x++) {
+                const Pixel &pixel = input[y][x];
+                sums_[Index(y + 1, x + 1)] = sums_[Index(y + 1, x)] + ChannelSums{pixel.red, pixel.green, pixel.blue};
+                if (with_squares) {
+                    ChannelSums squares = {static_cast<uint64_t>(pixel.red) * pixel.red,
+                                           static_cast<uint64_t>(pixel.green) * pixel.green,
+                                           static_cast<uint64_t>(pixel.blue) * pixel.blue};
+                    squared_sums_[Index(y + 1, x + 1)] = squared_sums_[Index(y + 1, x)] + squares;
+                }
+            }
+        }
+    });
+    RunParallel(width_, [&](int32_t begin, int32_t end) {
+        for (int32_t y = 1; y < height_; y++) {
+            for (int32_t x = begin + 1; x <= end; x++) {
+                sums_[Index(y + 1, x)] = sums_[Index(y + 1, x)] + sums_[Index(y, x)];
+                if (with_squares) {
+                    squared_sums_[Index(y + 1, x)] = squared_sums_[Index(y + 1, x)] + squared_sums_[Index(y, x)];
+                }
+            }
+        }
+    });
+}
+
+size_t IntegralImage::Index(int32_t y, int32_t x) const {
+    return static_cast<size_t>(y) * (width_ + 1) + x;
+}
+
+// Any window wider than the image covers all of it, so larger radii are equivalent and
+// clamping keeps the window arithmetic within int32_t.
+int32_t IntegralImage::ClampRadius(int32_t radius) const {
+    return std::min(radius, std::max(width_, height_));
+}
+
+ChannelSums IntegralImage::Lookup(const std::vector<ChannelSums> &table, int32_t top, int32_t left, int32_t bottom,
+                                  int32_t right) const {
+    top = std::max(top, 0);
+    left = std::max(left, 0);
+    bottom = std::min(bottom, height_ - 1);
+    right = std::min(right, width_ - 1);
+    if (top > bottom || left > right) {
+        return {};
+    }
+    const ChannelSums &a = table[Index(top, left)];
+    const ChannelSums &b = table[Index(top, right + 1)];
+    const ChannelSums &c = table[Index(bottom + 1, left)];
+    const ChannelSums &d = table[Index(bottom + 1, right + 1)];
+    return {d.red + a.red - b.red - c.red, d.green + a.green - b.green - c.green,
+            d.blue + a.blue - b.blue - c.blue};
+}
+
+ChannelSums IntegralImage::Sum(int32_t top, int32_t left, int32_t bottom, int32_t right) const {
+    return Lookup(sums_, top, left, bottom, right);
+}
+
+ChannelSums IntegralImage::SquaredSum(int32_t top, int32_t left, int32_t bottom, int32_t right) const {
+    if (squared_sums_.empty()) {
+        throw std::logic_error("Integral image was built without the squared sums table.");
+    }
+    return Lookup(squared_sums_, top, left, bottom, right);
+}
+
+int64_t IntegralImage::Area(int32_t top, int32_t left, int32_t bottom, int32_t right) const {
+    int64_t rows = std::min(bottom, height_ - 1) - std::max(top, 0) + 1;
+    int64_t columns = std::min(right, width_ - 1) - std::max(left, 0) + 1;
+    return (rows > 0 && columns > 0) ? rows * columns : 0;
+}
+
+ChannelStats IntegralImage::Mean(int32_t y, int32_t x, int32_t radius) const {
+    radius = ClampRadius(radius);
+    int64_t area = Area(y - radius, x - radius, y + radius, x + radius);
+    if (area == 0) {
+        return {};
+    }
+    ChannelSums sum = Sum(y - radius, x - radius, y + radius, x + radius);
+    float count = static_cast<float>(area);
+    return {static_cast<float>(sum.red) / count, static_cast<float>(sum.green) / count,
+            static_cast<float>(sum.blue) / count};
+}
+
+ChannelStats IntegralImage::Variance(int32_t y, int32_t x, int32_t radius) const {
+    radius = ClampRadius(radius);
+    int64_t area = Area(y - radius, x - radius, y + radius, x + radius);
+    if (area == 0) {
+        return {};
+    }
+    ChannelSums sum = Sum(y - radius, x - radius, y + radius, x + radius);
+    ChannelSums squared = SquaredSum(y - radius, x - radius, y + radius, x + radius);
+    double count = static_cast<double>(area);
+    auto variance = [count](uint64_t channel_sum, uint64_t channel_squared) {
+        double mean = static_cast<double>(channel_sum) / count;
+        return static_cast<float>(std::max(0.0, static_cast<double>(channel_squared) / count - mean * mean));
+    };
+    return {variance(sum.red, squared.red), variance(sum.green, squared.green), variance(sum.blue, squared.blue)};
+}
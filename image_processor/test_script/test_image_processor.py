@@ -51,6 +51,10 @@ class ImageProcessorTester:
                 ImageProcessorTester.TestCase(input="flag", name="edge", args=["-edge", "0.1"], eps=1.0),
                 ImageProcessorTester.TestCase(input="flag", name="edge_edge", args=["-edge", "0.1", "-edge", "0.5"],
                                               eps=1.0),
+                ImageProcessorTester.TestCase(input="flag", name="edge", args=["-edge", "0.1", "0"], eps=1.0),
+                ImageProcessorTester.TestCase(input="flag", name="edge_adaptive", args=["-edge", "0.05", "2"], eps=1.0),
+                ImageProcessorTester.TestCase(input="flag", name="edge_adaptive_big", args=["-edge", "0.1", "100"],
+                                              eps=1.0),
             ],
             "gs": [
                 ImageProcessorTester.TestCase(input="lenna", name="gs", args=["-gs"], eps=1.0),
@@ -72,6 +76,12 @@ class ImageProcessorTester:
                 ImageProcessorTester.TestCase(input="lenna", name="blur_blur", args=["-blur", "7.5", "-blur", "3"],
                                               eps=2.0),
             ],
+            "box": [
+                ImageProcessorTester.TestCase(input="flag", name="box", args=["-box", "1"], eps=1.0),
+                ImageProcessorTester.TestCase(input="flag", name="box_box", args=["-box", "1", "-box", "3"], eps=1.0),
+                ImageProcessorTester.TestCase(input="flag", name="box_big", args=["-box", "100"], eps=1.0),
+                ImageProcessorTester.TestCase(input="flag", name="box_zero", args=["-box", "0"], eps=0.0),
+            ],
         }
         ok_filters = set()
 